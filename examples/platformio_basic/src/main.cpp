@@ -13,6 +13,10 @@ static void onOrientalEvent(uint8_t id, const char* msg) {
   Serial.printf("M%u %s\r\n", id, msg);
 }
 
+static void onMoveDone(const VJ_OrientalMaster::MoveHandle& h, VJ_OrientalMaster::MoveState state, uint32_t durationMs) {
+  Serial.printf("M%u move #%u -> state %u after %lu ms\r\n", h.id, h.seq, (unsigned)state, (unsigned long)durationMs);
+}
+
 // Example motion profile (user-units; will be scaled by MPA ratios)
 static const uint8_t  MOTOR_ID = 1;
 static const uint16_t OP_TYPE  = 3;       // Incremental positioning (based on feedback position)
@@ -38,6 +42,13 @@ void setup() {
   oriental.setInterframeDelayMs(4);
   oriental.setPollIntervalMs(50);
 
+  // Optional: learn per-slave timeout and shrink the inter-frame gap from measured traffic
+  oriental.setBusBaud(115200);
+  if (!oriental.setAdaptiveTimeout(true)) {
+    Serial.println("ModbusMaster has no timeout setter -> adaptive timeout not available");
+  }
+  oriental.setAdaptiveInterframe(true);
+
   // Configure ratios (example):
   // R_POS=100 => any position you pass will be *100 before sending to drive
   // R_FBP=10  => feedback position read back will be /10
@@ -67,7 +78,9 @@ void loop() {
     f.hasDec    = true; f.dec    = DEC;
     f.hasCur    = true; f.cur    = CUR;
 
-    bool ok = oriental.SMP(MOTOR_ID, f);
+    // Tracked move: completion reported via onMoveDone (5 s deadline)
+    VJ_OrientalMaster::MoveHandle move;
+    bool ok = oriental.SMP(MOTOR_ID, f, move, 5000, onMoveDone);
     Serial.printf("SMP -> %s\r\n", ok ? "OK" : "ERR");
 
     // Example: if alarm is set, pulse RESET
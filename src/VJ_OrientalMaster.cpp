@@ -11,7 +11,11 @@ bool VJ_OrientalMaster::begin(Stream& bus) {
 
 void VJ_OrientalMaster::setEventCallback(EventCallback cb) { _cb = cb; }
 void VJ_OrientalMaster::setPollIntervalMs(uint32_t intervalMs) { _pollIntervalMs = intervalMs; }
-void VJ_OrientalMaster::setInterframeDelayMs(uint16_t delayMs) { _interframeDelayMs = delayMs; }
+void VJ_OrientalMaster::setInterframeDelayMs(uint16_t delayMs) {
+  _interframeDelayMs = delayMs;
+  _gapUs = (uint32_t)delayMs * 1000u;
+  _gapOkRun = 0;
+}
 
 void VJ_OrientalMaster::setModbusTimeoutMs(uint16_t timeoutMs) {
   if (timeoutMs < 30) timeoutMs = 30;
@@ -25,6 +29,53 @@ void VJ_OrientalMaster::setResetPulseMs(uint16_t pulseMs) {
   _resetPulseMs = pulseMs;
 }
 
+bool VJ_OrientalMaster::setAdaptiveTimeout(bool enable) {
+  if (enable && !canSetModbusTimeout()) {
+    _adaptTimeout = false;
+    return false;
+  }
+  _adaptTimeout = enable;
+  for (auto &m : _motors) {
+    m.rspHead = 0; m.rspCount = 0; m.rspMaxMs = 0; m.timeoutMs = 0;
+  }
+  return true;
+}
+
+void VJ_OrientalMaster::setAdaptiveTimeoutLimits(uint16_t floorMs, uint16_t marginMs) {
+  if (floorMs < 5) floorMs = 5;
+  if (floorMs > 2000) floorMs = 2000;
+  if (marginMs > 1000) marginMs = 1000;
+  _adaptFloorMs = floorMs;
+  _adaptMarginMs = marginMs;
+}
+
+void VJ_OrientalMaster::setBusBaud(uint32_t baud) {
+  _busBaud = baud;
+}
+
+void VJ_OrientalMaster::setAdaptiveInterframe(bool enable) {
+  _adaptGap = enable;
+  _gapUs = (uint32_t)_interframeDelayMs * 1000u;
+  _gapOkRun = 0;
+}
+
+uint16_t VJ_OrientalMaster::getEffectiveTimeoutMs(uint8_t id) {
+  if (!canSetModbusTimeout()) return MB_FIXED_TIMEOUT_MS;
+  if (!_adaptTimeout) return _mbTimeoutMs;
+  MotorState* m = findMotor(id);
+  if (!m || m->timeoutMs == 0) return _mbTimeoutMs;
+  return (m->timeoutMs < _mbTimeoutMs) ? m->timeoutMs : _mbTimeoutMs;
+}
+
+uint16_t VJ_OrientalMaster::getResponseMaxMs(uint8_t id) {
+  MotorState* m = findMotor(id);
+  return m ? m->rspMaxMs : 0;
+}
+
+uint32_t VJ_OrientalMaster::getEffectiveInterframeUs() const {
+  return _adaptGap ? _gapUs : (uint32_t)_interframeDelayMs * 1000u;
+}
+
 VJ_OrientalMaster::MotorState* VJ_OrientalMaster::findMotor(uint8_t id) {
   for (auto &m : _motors) if (m.used && m.id == id) return &m;
   return nullptr;
@@ -41,9 +92,39 @@ VJ_OrientalMaster::MotorState* VJ_OrientalMaster::ensureMotor(uint8_t id) {
 }
 
 void VJ_OrientalMaster::mbGap() {
+  if (_adaptGap) {
+    if (_gapUs >= 1000) delay(_gapUs / 1000);
+    if (_gapUs % 1000) delayMicroseconds(_gapUs % 1000);
+    return;
+  }
   if (_interframeDelayMs) delay(_interframeDelayMs);
 }
 
+// Modbus RTU: 3.5 char times between frames, fixed 1750 us above 19200 baud.
+// Without a known baud rate the static delay is the minimum (no shrinking).
+uint32_t VJ_OrientalMaster::minGapUs() const {
+  if (_busBaud == 0) return (uint32_t)_interframeDelayMs * 1000u;
+  if (_busBaud > 19200) return 1750;
+  return (38500000u + _busBaud - 1) / _busBaud;   // 3.5 * 11 bit
+}
+
+void VJ_OrientalMaster::recordResponse(MotorState& m, uint16_t ms) {
+  m.rspMs[m.rspHead] = ms;
+  m.rspHead = (uint8_t)((m.rspHead + 1) % RSP_WINDOW);
+  if (m.rspCount < RSP_WINDOW) m.rspCount++;
+  if (m.rspCount < RSP_MIN_SAMPLES) return;
+
+  // with 32 samples p99 (ceil(0.99 * n)) is the window max -> just take the max
+  uint16_t mx = 0;
+  for (uint8_t i = 0; i < m.rspCount; i++) if (m.rspMs[i] > mx) mx = m.rspMs[i];
+  m.rspMaxMs = mx;
+
+  int32_t to = (int32_t)m.rspMaxMs + m.rspMaxMs / 2 + _adaptMarginMs;
+  uint16_t hi = _mbTimeoutMs;
+  uint16_t lo = (_adaptFloorMs < hi) ? _adaptFloorMs : hi;
+  m.timeoutMs = clampU16(to, lo, hi);
+}
+
 // --- best-effort timeout setters (works with different ModbusMaster forks) ---
 // NOTE: MUST be at file scope (NOT inside beginTxn)
 template<typename T>
@@ -58,10 +139,77 @@ static auto trySetResponseTimeout(T& node, uint16_t ms, int) -> decltype(node.se
 }
 static void trySetResponseTimeout(...) {}
 
+// same checks at compile time (no side effect on the node)
+template<typename T>
+static constexpr auto hasSetTimeout(T* node, int) -> decltype(node->setTimeout((uint16_t)0), bool()) {
+  return true;
+}
+static constexpr bool hasSetTimeout(...) { return false; }
+
+template<typename T>
+static constexpr auto hasSetResponseTimeout(T* node, int) -> decltype(node->setResponseTimeout((uint16_t)0), bool()) {
+  return true;
+}
+static constexpr bool hasSetResponseTimeout(...) { return false; }
+
+static constexpr bool MB_TIMEOUT_SETTABLE =
+    hasSetTimeout((ModbusMaster*)nullptr, 0) || hasSetResponseTimeout((ModbusMaster*)nullptr, 0);
+
+bool VJ_OrientalMaster::canSetModbusTimeout() { return MB_TIMEOUT_SETTABLE; }
+
 void VJ_OrientalMaster::beginTxn(uint8_t id) {
+  uint16_t timeoutMs = getEffectiveTimeoutMs(id);
   _node.begin(id, *_bus);
-  trySetTimeout(_node, _mbTimeoutMs, 0);
-  trySetResponseTimeout(_node, _mbTimeoutMs, 0);
+  trySetTimeout(_node, timeoutMs, 0);
+  trySetResponseTimeout(_node, timeoutMs, 0);
+}
+
+void VJ_OrientalMaster::endTxn(uint8_t id, uint8_t result, uint32_t startUs) {
+  MotorState* m = findMotor(id);
+
+  if (result == ModbusMaster::ku8MBSuccess) {
+    // profile also feeds the gap back-off below, so keep it for either mode
+    if ((_adaptTimeout || _adaptGap) && m) {
+      uint32_t ms = ((uint32_t)(micros() - startUs) + 999u) / 1000u;
+      recordResponse(*m, (uint16_t)(ms > 0xFFFF ? 0xFFFF : ms));
+    }
+    if (_adaptGap && ++_gapOkRun >= GAP_SHRINK_AFTER) {
+      _gapOkRun = 0;
+      // never raise the gap here: a static gap already below spec is left alone
+      uint32_t lo = minGapUs();
+      uint32_t step = _gapUs / 8;
+      if (step == 0) step = 1;
+      if (_gapUs > lo) _gapUs = (_gapUs > lo + step) ? _gapUs - step : lo;
+    }
+    return;
+  }
+
+  _gapOkRun = 0;
+
+  if (result == ModbusMaster::ku8MBResponseTimedOut) {
+    // a slave that normally answers went silent -> on half-duplex most likely a collision
+    // (request discarded); an absent slave (no profile) must not inflate the gap
+    if (_adaptGap && m && m->rspCount >= RSP_MIN_SAMPLES) widenGap();
+    // slave slower than learned (or gone): back to the static timeout and re-learn
+    if (m) { m->rspHead = 0; m->rspCount = 0; m->rspMaxMs = 0; m->timeoutMs = 0; }
+    return;
+  }
+
+  // garbled reply (CRC / wrong slave / wrong function) -> likely collision, widen the gap
+  if (_adaptGap &&
+      (result == ModbusMaster::ku8MBInvalidCRC ||
+       result == ModbusMaster::ku8MBInvalidSlaveID ||
+       result == ModbusMaster::ku8MBInvalidFunction)) {
+    widenGap();
+  }
+}
+
+// setInterframeDelayMs() is a hard ceiling, even if it is below 3.5 char times
+void VJ_OrientalMaster::widenGap() {
+  uint32_t lo = minGapUs();
+  uint32_t hi = (uint32_t)_interframeDelayMs * 1000u;
+  uint32_t g = (_gapUs < lo) ? lo : _gapUs * 2;
+  _gapUs = (g > hi) ? hi : g;
 }
 
 uint16_t VJ_OrientalMaster::hi16(int32_t v) { return (uint16_t)((uint32_t)v >> 16); }
@@ -93,7 +241,9 @@ int32_t VJ_OrientalMaster::scaleDiv(int32_t value, int32_t ratio) const {
 bool VJ_OrientalMaster::readHolding(uint8_t id, uint16_t addr, uint16_t qty, uint16_t* out) {
   if (!_bus || !out || qty == 0) return false;
   beginTxn(id);
+  uint32_t t0 = micros();
   uint8_t r = _node.readHoldingRegisters(addr, qty);
+  endTxn(id, r, t0);
   if (r != ModbusMaster::ku8MBSuccess) { mbGap(); return false; }
   for (uint16_t i = 0; i < qty; i++) out[i] = _node.getResponseBuffer(i);
   mbGap();
@@ -103,7 +253,9 @@ bool VJ_OrientalMaster::readHolding(uint8_t id, uint16_t addr, uint16_t qty, uin
 bool VJ_OrientalMaster::writeSingle(uint8_t id, uint16_t addr, uint16_t value) {
   if (!_bus) return false;
   beginTxn(id);
+  uint32_t t0 = micros();
   uint8_t r = _node.writeSingleRegister(addr, value);
+  endTxn(id, r, t0);
   mbGap();
   return r == ModbusMaster::ku8MBSuccess;
 }
@@ -113,7 +265,9 @@ bool VJ_OrientalMaster::writeMultiple(uint8_t id, uint16_t addr, const uint16_t*
   beginTxn(id);
   _node.clearTransmitBuffer();
   for (uint16_t i = 0; i < qty; i++) _node.setTransmitBuffer(i, values[i]);
+  uint32_t t0 = micros();
   uint8_t r = _node.writeMultipleRegisters(addr, qty);
+  endTxn(id, r, t0);
   mbGap();
   return r == ModbusMaster::ku8MBSuccess;
 }
@@ -181,7 +335,24 @@ bool VJ_OrientalMaster::SMP(uint8_t id, const SMPFields& f) {
   w[14] = 0x0000;
   w[15] = 0x0001; // trigger: all data updated
 
-  return writeMultiple(id, REG_DDO_BASE, w, REG_DDO_WORDS);
+  if (!writeMultiple(id, REG_DDO_BASE, w, REG_DDO_WORDS)) return false;
+  abortMove(id);
+  return true;
+}
+
+bool VJ_OrientalMaster::SMP(uint8_t id, const SMPFields& f, MoveHandle& h,
+                            uint32_t timeoutMs, MoveCallback cb) {
+  uint32_t t0 = millis();
+  if (!SMP(id, f)) return false;
+  MotorState* m = findMotor(id);
+  if (!m) return false;
+  armMove(*m, h, t0, timeoutMs, cb);
+  return true;
+}
+
+static bool changesMotion(VJ_OrientalMaster::Input input) {
+  return input == VJ_OrientalMaster::START || input == VJ_OrientalMaster::ZHOME ||
+         input == VJ_OrientalMaster::STOP  || input == VJ_OrientalMaster::FREE;
 }
 
 static uint16_t inputBitMask(VJ_OrientalMaster::Input input) {
@@ -199,7 +370,9 @@ bool VJ_OrientalMaster::SIN(uint8_t id, Input input, bool state) {
   (void)ensureMotor(id);
   uint16_t mask = state ? inputBitMask(input) : 0u;
   uint16_t regs[2] = {0x0000, mask};
-  return writeMultiple(id, REG_IN_REF_UP, regs, 2);
+  if (!writeMultiple(id, REG_IN_REF_UP, regs, 2)) return false;
+  if (state && changesMotion(input)) abortMove(id);
+  return true;
 }
 
 bool VJ_OrientalMaster::SIP(uint8_t id, Input input) {
@@ -213,7 +386,20 @@ bool VJ_OrientalMaster::SIP(uint8_t id, Input input) {
 
   uint16_t mask = inputBitMask(input);
   uint16_t regs[2] = {0x0000, mask};
-  return writeMultiple(id, REG_IN_AUTO_UP, regs, 2);
+  if (!writeMultiple(id, REG_IN_AUTO_UP, regs, 2)) return false;
+  if (changesMotion(input)) abortMove(id);
+  return true;
+}
+
+bool VJ_OrientalMaster::SIP(uint8_t id, Input input, MoveHandle& h,
+                            uint32_t timeoutMs, MoveCallback cb) {
+  if (input != START && input != ZHOME) return false;
+  uint32_t t0 = millis();
+  if (!SIP(id, input)) return false;
+  MotorState* m = findMotor(id);
+  if (!m) return false;
+  armMove(*m, h, t0, timeoutMs, cb);
+  return true;
 }
 
 bool VJ_OrientalMaster::readOutRaw(uint8_t id, uint16_t& raw) {
@@ -295,9 +481,78 @@ void VJ_OrientalMaster::emitEvent(uint8_t id, const char* tag, bool v) {
   _cb(id, msg);
 }
 
+// ===== Move tracking =====
+void VJ_OrientalMaster::armMove(MotorState& m, MoveHandle& h, uint32_t startMs,
+                                uint32_t timeoutMs, MoveCallback cb) {
+  if (++m.mvSeq == 0) m.mvSeq = 1;
+  m.mvState = MV_PENDING;
+  m.mvSawMotion = false;
+  m.mvStartMs = startMs;
+  m.mvEndMs = startMs;
+  m.mvTimeoutMs = timeoutMs;
+  m.mvCb = cb;
+  h.id = m.id;
+  h.seq = m.mvSeq;
+}
+
+void VJ_OrientalMaster::finishMove(MotorState& m, MoveState state, uint32_t now) {
+  m.mvState = state;
+  m.mvEndMs = now;
+  if (m.mvCb) {
+    MoveHandle h;
+    h.id = m.id;
+    h.seq = m.mvSeq;
+    m.mvCb(h, state, (uint32_t)(now - m.mvStartMs));
+  }
+}
+
+void VJ_OrientalMaster::trackMove(MotorState& m, bool mov, bool ipo, bool alm, uint32_t now) {
+  if (m.mvState != MV_PENDING && m.mvState != MV_MOVING) return;
+  if (alm) { finishMove(m, MV_ALARM, now); return; }
+  // INPOS still set from the previous move -> wait until MOVE or !INPOS was seen
+  if (mov || !ipo) m.mvSawMotion = true;
+  if (mov) { m.mvState = MV_MOVING; return; }
+  if (m.mvSawMotion && ipo) finishMove(m, MV_DONE, now);
+}
+
+// another motion command overrides the tracked move -> end it so the old handle
+// doesn't resolve on the new move's INPOS
+void VJ_OrientalMaster::abortMove(uint8_t id) {
+  MotorState* m = findMotor(id);
+  if (!m || (m->mvState != MV_PENDING && m->mvState != MV_MOVING)) return;
+  finishMove(*m, MV_ABORTED, millis());
+}
+
+VJ_OrientalMaster::MotorState* VJ_OrientalMaster::findMove(const MoveHandle& h) {
+  if (h.seq == 0) return nullptr;
+  MotorState* m = findMotor(h.id);
+  if (!m || m->mvSeq != h.seq) return nullptr;
+  return m;
+}
+
+VJ_OrientalMaster::MoveState VJ_OrientalMaster::getMoveState(const MoveHandle& h) {
+  MotorState* m = findMove(h);
+  return m ? m->mvState : MV_NONE;
+}
+
+uint32_t VJ_OrientalMaster::getMoveDurationMs(const MoveHandle& h) {
+  MotorState* m = findMove(h);
+  if (!m) return 0;
+  if (m->mvState == MV_PENDING || m->mvState == MV_MOVING) return (uint32_t)(millis() - m->mvStartMs);
+  return (uint32_t)(m->mvEndMs - m->mvStartMs);
+}
+
 void VJ_OrientalMaster::update() {
-  if (_pollIntervalMs == 0) return;
   uint32_t now = millis();
+
+  // deadlines need no bus traffic -> checked on every call
+  for (auto &m : _motors) {
+    if (!m.used || m.mvTimeoutMs == 0) continue;
+    if (m.mvState != MV_PENDING && m.mvState != MV_MOVING) continue;
+    if ((uint32_t)(now - m.mvStartMs) >= m.mvTimeoutMs) finishMove(m, MV_TIMEOUT, now);
+  }
+
+  if (_pollIntervalMs == 0) return;
   if ((uint32_t)(now - _lastPollMs) < _pollIntervalMs) return;
   _lastPollMs = now;
 
@@ -313,26 +568,165 @@ void VJ_OrientalMaster::update() {
     if (readPresentAlarm(m.id, alarmCode)) alm = (alarmCode != 0);
     bool mov = (raw & (1u << 13)) != 0;
     bool ipo = (raw & (1u << 14)) != 0;
+    bool movRise = m.outInit && mov && !m.lastMove;
+    bool ipoRise = m.outInit && ipo && !m.lastInPos;
 
     if (!m.outInit) {
       m.lastReady = rdy; m.lastAlarm = alm; m.lastMove = mov; m.lastInPos = ipo;
       m.outInit = true;
-      continue;
+    } else {
+      if (rdy != m.lastReady) { m.lastReady = rdy; emitEvent(m.id, "RDY", rdy); }
+      if (alm != m.lastAlarm) { m.lastAlarm = alm; emitEvent(m.id, "ALM", alm); }
+      if (mov != m.lastMove)  { m.lastMove  = mov; emitEvent(m.id, "MOV", mov); }
+      if (ipo != m.lastInPos) { m.lastInPos = ipo; emitEvent(m.id, "IPO", ipo); }
     }
 
-    if (rdy != m.lastReady) { m.lastReady = rdy; emitEvent(m.id, "RDY", rdy); }
-    if (alm != m.lastAlarm) { m.lastAlarm = alm; emitEvent(m.id, "ALM", alm); }
-    if (mov != m.lastMove)  { m.lastMove  = mov; emitEvent(m.id, "MOV", mov); }
-    if (ipo != m.lastInPos) { m.lastInPos = ipo; emitEvent(m.id, "IPO", ipo); }
+    trackMove(m, mov, ipo, alm, now);
+    recPoll(m, raw, alarmCode, movRise, ipoRise);
   }
 }
 
+// ===== Telemetry recorder =====
+bool VJ_OrientalMaster::recAttach(uint8_t id, TelemetrySample* buf, uint16_t capacity) {
+  MotorState* m = ensureMotor(id);
+  if (!m) return false;
+  if (!buf || capacity == 0) { buf = nullptr; capacity = 0; }
+  m->recBuf = buf;
+  m->recCap = capacity;
+  m->recHead = 0;
+  m->recCount = 0;
+  m->recDropped = 0;
+  m->recState = RS_IDLE;
+  return buf != nullptr;
+}
+
+bool VJ_OrientalMaster::recConfig(uint8_t id, uint8_t decimation, int32_t deadband, RecTrigger trigger) {
+  MotorState* m = findMotor(id);
+  if (!m) return false;
+  m->recDecim = (decimation == 0) ? 1 : decimation;
+  m->recDeadband = (deadband < 0) ? 0 : deadband;
+  m->recTrigger = trigger;
+  return true;
+}
+
+bool VJ_OrientalMaster::recStart(uint8_t id) {
+  MotorState* m = findMotor(id);
+  if (!m || !m->recBuf) return false;
+  m->recHead = 0;
+  m->recCount = 0;
+  m->recDropped = 0;
+  m->recDecimCtr = 0;
+  m->recState = (m->recTrigger == REC_MOVE) ? RS_ARMED : RS_RUN;
+  return true;
+}
+
+bool VJ_OrientalMaster::recStop(uint8_t id) {
+  MotorState* m = findMotor(id);
+  if (!m) return false;
+  m->recState = RS_IDLE;
+  return true;
+}
+
+bool VJ_OrientalMaster::recIsRecording(uint8_t id) {
+  MotorState* m = findMotor(id);
+  return m && m->recState == RS_RUN;
+}
+
+uint16_t VJ_OrientalMaster::recCount(uint8_t id) {
+  MotorState* m = findMotor(id);
+  return m ? m->recCount : 0;
+}
+
+static bool withinBand(int32_t a, int32_t b, int32_t band) {
+  int64_t d = (int64_t)a - (int64_t)b;
+  if (d < 0) d = -d;
+  return d < (int64_t)band;
+}
+
+void VJ_OrientalMaster::recPoll(MotorState& m, uint16_t raw, uint16_t alarmCode,
+                                bool movRise, bool ipoRise) {
+  if (!m.recBuf || m.recState == RS_IDLE) return;
+  if (m.recState == RS_ARMED) {
+    if (!movRise) return;
+    m.recState = RS_RUN;
+    m.recDecimCtr = 0;
+  }
+
+  // always keep the sample that ends a triggered capture
+  bool last = (m.recTrigger == REC_MOVE) && ipoRise;
+  if (last) m.recState = RS_IDLE;
+
+  if (!last && m.recDecimCtr != 0) { m.recDecimCtr--; return; }
+  m.recDecimCtr = (uint8_t)(m.recDecim - 1);
+
+  // FBPOS (0x0120/21) and CMDPOS (0x0122/23) in one read
+  uint16_t regs[4] = {0, 0, 0, 0};
+  if (!readHolding(m.id, REG_FBPOS_UP, 4, regs)) return;
+
+  // stamp at the position read, not at the start of update() (earlier reads/gaps)
+  TelemetrySample s;
+  s.tMs = millis();
+  s.fbp = scaleDiv((int32_t)(((uint32_t)regs[0] << 16) | regs[1]), m.rFbp);
+  s.cmp = scaleDiv((int32_t)(((uint32_t)regs[2] << 16) | regs[3]), m.rCmp);
+  s.out = raw;
+  s.alarm = alarmCode;
+
+  if (!last && m.recDeadband > 0 && m.recCount > 0) {
+    const TelemetrySample& p = m.recBuf[(m.recHead + m.recCap - 1) % m.recCap];
+    if (p.out == s.out && p.alarm == s.alarm &&
+        withinBand(s.fbp, p.fbp, m.recDeadband) &&
+        withinBand(s.cmp, p.cmp, m.recDeadband)) return;
+  }
+
+  m.recBuf[m.recHead] = s;
+  m.recHead = (uint16_t)((m.recHead + 1) % m.recCap);
+  if (m.recCount < m.recCap) m.recCount++;
+  else m.recDropped++;
+}
+
+static uint8_t* putLE(uint8_t* p, uint32_t v, uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; i++) { *p++ = (uint8_t)(v & 0xFF); v >>= 8; }
+  return p;
+}
+
+size_t VJ_OrientalMaster::recExport(uint8_t id, uint8_t* out, size_t maxLen) {
+  MotorState* m = findMotor(id);
+  if (!m || !m->recBuf || !out || maxLen < REC_HEADER_BYTES) return 0;
+
+  size_t fit = (maxLen - REC_HEADER_BYTES) / REC_SAMPLE_BYTES;
+  uint16_t n = (fit < m->recCount) ? (uint16_t)fit : m->recCount;
+
+  uint8_t* p = out;
+  *p++ = 'V'; *p++ = 'J'; *p++ = 'T'; *p++ = 'R';
+  *p++ = REC_EXPORT_VERSION;
+  *p++ = m->id;
+  *p++ = REC_SAMPLE_BYTES;
+  *p++ = m->recDecim;
+  p = putLE(p, n, 2);
+  p = putLE(p, m->recCount, 2);   // total in ring; > count -> truncated by maxLen
+  p = putLE(p, m->recDropped, 4);
+
+  // too small for all -> keep the newest n (end of a triggered capture)
+  uint16_t oldest = (uint16_t)((m->recHead + m->recCap - n) % m->recCap);
+  for (uint16_t i = 0; i < n; i++) {
+    const TelemetrySample& s = m->recBuf[(oldest + i) % m->recCap];
+    p = putLE(p, s.tMs, 4);
+    p = putLE(p, (uint32_t)s.fbp, 4);
+    p = putLE(p, (uint32_t)s.cmp, 4);
+    p = putLE(p, s.out, 2);
+    p = putLE(p, s.alarm, 2);
+  }
+  return (size_t)(p - out);
+}
+
 // ===== Direct Data helpers (Variant A) =====
 bool VJ_OrientalMaster::DDOSetTrigger(uint8_t id, int16_t trigger) {
   (void)ensureMotor(id);
   int32_t v = (int32_t)trigger;
   uint16_t regs[2] = { hi16(v), lo16(v) };
-  return writeMultiple(id, REG_DDO_TRIG_UP, regs, 2);
+  if (!writeMultiple(id, REG_DDO_TRIG_UP, regs, 2)) return false;
+  abortMove(id);
+  return true;
 }
 
 bool VJ_OrientalMaster::DDOSetOperatingSpeed(uint8_t id, int32_t speedHz) {
@@ -341,7 +735,9 @@ bool VJ_OrientalMaster::DDOSetOperatingSpeed(uint8_t id, int32_t speedHz) {
   int32_t scaled = scaleMul(speedHz, m->rSpd);
   m->spd = scaled;
   uint16_t regs[2] = { hi16(scaled), lo16(scaled) };
-  return writeMultiple(id, REG_DDO_SPD_UP, regs, 2);
+  if (!writeMultiple(id, REG_DDO_SPD_UP, regs, 2)) return false;
+  abortMove(id);
+  return true;
 }
 
 bool VJ_OrientalMaster::DDOSetForwardingDestination(uint8_t id, uint16_t dest) {
@@ -51,7 +51,43 @@ public:
     uint16_t opDataNo{0};
   };
 
+  // Move tracking: state is derived from the MOVE/INPOS/ALARM bits read by update().
+  enum MoveState : uint8_t {
+    MV_NONE,      // unknown or superseded handle
+    MV_PENDING,   // command accepted, no motion seen yet
+    MV_MOVING,
+    MV_DONE,
+    MV_ALARM,
+    MV_TIMEOUT,
+    MV_ABORTED    // ended by another motion command (SMP / START / ZHOME / STOP / FREE / DDO)
+  };
+
+  struct MoveHandle {
+    uint8_t id{0};
+    uint16_t seq{0};
+  };
+
+  // Telemetry recorder sample (positions scaled like GFP/GCP).
+  struct TelemetrySample {
+    uint32_t tMs{0};
+    int32_t fbp{0};
+    int32_t cmp{0};
+    uint16_t out{0};     // raw output word
+    uint16_t alarm{0};   // present alarm code
+  };
+
+  enum RecTrigger : uint8_t {
+    REC_MANUAL,   // recStart() .. recStop()
+    REC_MOVE      // recStart() arms: start on MOVE rising edge, stop on INPOS rising edge
+  };
+
+  // Export block: 16 byte header + count * 16 byte samples, little endian (see README).
+  static constexpr uint8_t REC_EXPORT_VERSION = 1;
+  static constexpr uint8_t REC_HEADER_BYTES = 16;
+  static constexpr uint8_t REC_SAMPLE_BYTES = 16;
+
   using EventCallback = void (*)(uint8_t id, const char* msg);
+  using MoveCallback = void (*)(const MoveHandle& h, MoveState state, uint32_t durationMs);
 
   VJ_OrientalMaster();
 
@@ -63,10 +99,33 @@ public:
 
   // Reduce blocking in case of missing slave response (prevents WDT in bad wiring cases).
   // If the underlying ModbusMaster supports setTimeout()/setResponseTimeout(), we apply it.
+  // The pinned 4-20ma/ModbusMaster has neither (fixed 2000 ms) -> canSetModbusTimeout() == false.
   void setModbusTimeoutMs(uint16_t timeoutMs);
+  static bool canSetModbusTimeout();
 
   void setResetPulseMs(uint16_t pulseMs);
 
+  // ===== Adaptive bus timing (off by default) =====
+  // Per-slave timeout = max of the last 32 response times * 1.5 + margin, clamped to
+  // [floor .. setModbusTimeoutMs()]. Until enough responses are measured (or after a
+  // timeout) the static setModbusTimeoutMs() value is used.
+  // Needs a ModbusMaster with a timeout setter; otherwise enabling returns false
+  // and the library's fixed timeout stays in force.
+  bool setAdaptiveTimeout(bool enable);
+  void setAdaptiveTimeoutLimits(uint16_t floorMs, uint16_t marginMs);
+
+  // Inter-frame gap shrinks toward 3.5 char times while frames succeed and backs off
+  // on CRC / framing errors and on timeouts of a slave that normally answers
+  // (collision -> request lost); setInterframeDelayMs() is the upper limit
+  // (a static gap already below 3.5 char times is never raised).
+  // Needs the bus baud rate (8E1 / 8N2 = 11 bits per char assumed).
+  void setBusBaud(uint32_t baud);
+  void setAdaptiveInterframe(bool enable);
+
+  uint16_t getEffectiveTimeoutMs(uint8_t id);  // timeout actually in force for this slave
+  uint16_t getResponseMaxMs(uint8_t id);      // window max (>= p99), 0 = not enough samples yet
+  uint32_t getEffectiveInterframeUs() const;
+
   bool MPA(uint8_t id,
            int32_t R_POS,
            int32_t R_SPD,
@@ -78,12 +137,27 @@ public:
 
   bool SMP(uint8_t id, const SMPFields& f);
 
+  // Same as above, but track the move (one per motor). timeoutMs = 0 -> no deadline.
+  // cb fires once on DONE / ALARM / TIMEOUT (from update()) or ABORTED (any later
+  // SMP, START / ZHOME, STOP / FREE, DDOSetTrigger / DDOSetOperatingSpeed on this
+  // motor ends the tracked move).
+  // Note: a move shorter than the poll interval may not be seen at all -> use a deadline.
+  bool SMP(uint8_t id, const SMPFields& f, MoveHandle& h,
+           uint32_t timeoutMs = 0, MoveCallback cb = nullptr);
+
   bool SIN(uint8_t id, Input input, bool state);
   bool SIN(uint8_t id, const char* inputName, bool state);
 
   bool SIP(uint8_t id, Input input);
   bool SIP(uint8_t id, const char* inputName);
 
+  // Tracked START / ZHOME pulse (see SMP with MoveHandle).
+  bool SIP(uint8_t id, Input input, MoveHandle& h,
+           uint32_t timeoutMs = 0, MoveCallback cb = nullptr);
+
+  MoveState getMoveState(const MoveHandle& h);
+  uint32_t getMoveDurationMs(const MoveHandle& h);   // command -> end (or -> now while running)
+
   bool GOU(uint8_t id, Output output, bool& value);
   bool GOU(uint8_t id, uint16_t& rawWord);
 
@@ -94,6 +168,20 @@ public:
 
   void update();
 
+  // ===== Telemetry recorder (sampled by update(), one extra 4-word read per poll while recording) =====
+  // buf is owned by the caller (e.g. static array); the library never allocates.
+  // The ring overwrites the oldest samples when full.
+  bool recAttach(uint8_t id, TelemetrySample* buf, uint16_t capacity);
+  // decimation: keep every n-th poll (1 = all). deadband: drop a sample if fbp/cmp moved
+  // less than deadband and out/alarm are unchanged (0 = off).
+  bool recConfig(uint8_t id, uint8_t decimation, int32_t deadband, RecTrigger trigger);
+  bool recStart(uint8_t id);   // clears the ring; REC_MOVE only arms
+  bool recStop(uint8_t id);
+  bool recIsRecording(uint8_t id);
+  uint16_t recCount(uint8_t id);
+  // Oldest first, returns bytes. If maxLen is too small, only the newest samples are exported.
+  size_t recExport(uint8_t id, uint8_t* out, size_t maxLen);
+
   // ===== Direct Data helpers for Variant A (continuous speed) =====
   // Trigger values per manual: -4 = Operating speed trigger/update. 
   bool DDOSetTrigger(uint8_t id, int16_t trigger);
@@ -105,6 +193,17 @@ public:
   bool execute(const String& cmd, String& reply);
 
 private:
+  static constexpr uint8_t RSP_WINDOW = 32;
+  static constexpr uint8_t RSP_MIN_SAMPLES = 8;
+  static constexpr uint8_t GAP_SHRINK_AFTER = 16;   // successful frames per gap step
+  static constexpr uint16_t MB_FIXED_TIMEOUT_MS = 2000;   // ModbusMaster without setter (ku16MBResponseTimeout)
+
+  enum RecState : uint8_t {
+    RS_IDLE,
+    RS_ARMED,
+    RS_RUN
+  };
+
   struct MotorState {
     bool used{false};
     uint8_t id{0};
@@ -125,6 +224,34 @@ private:
     bool lastMove{false};
     bool lastInPos{false};
     bool outInit{false};
+
+    // response time window for adaptive timeout
+    uint16_t rspMs[RSP_WINDOW]{};
+    uint8_t rspHead{0};
+    uint8_t rspCount{0};
+    uint16_t rspMaxMs{0};
+    uint16_t timeoutMs{0};        // 0 = use _mbTimeoutMs
+
+    // tracked move
+    uint16_t mvSeq{0};
+    MoveState mvState{MV_NONE};
+    bool mvSawMotion{false};
+    uint32_t mvStartMs{0};
+    uint32_t mvEndMs{0};
+    uint32_t mvTimeoutMs{0};
+    MoveCallback mvCb{nullptr};
+
+    // telemetry recorder (buffer owned by caller)
+    TelemetrySample* recBuf{nullptr};
+    uint16_t recCap{0};
+    uint16_t recHead{0};
+    uint16_t recCount{0};
+    uint32_t recDropped{0};
+    uint8_t recDecim{1};
+    uint8_t recDecimCtr{0};
+    int32_t recDeadband{0};
+    RecTrigger recTrigger{REC_MANUAL};
+    RecState recState{RS_IDLE};
   };
 
   Stream* _bus{nullptr};
@@ -140,6 +267,15 @@ private:
   uint16_t _mbTimeoutMs{200};   // keep small to avoid WDT on missing slave
   uint32_t _lastPollMs{0};
 
+  bool _adaptTimeout{false};
+  uint16_t _adaptFloorMs{30};
+  uint16_t _adaptMarginMs{10};
+
+  bool _adaptGap{false};
+  uint32_t _busBaud{0};
+  uint32_t _gapUs{4000};
+  uint8_t _gapOkRun{0};
+
   // registers
   static constexpr uint16_t REG_DDO_BASE = 0x0058;
   static constexpr uint16_t REG_DDO_WORDS = 16;
@@ -162,6 +298,11 @@ private:
 
   void mbGap();
   void beginTxn(uint8_t id);
+  void endTxn(uint8_t id, uint8_t result, uint32_t startUs);
+
+  uint32_t minGapUs() const;
+  void recordResponse(MotorState& m, uint16_t ms);
+  void widenGap();
 
   static uint16_t hi16(int32_t v);
   static uint16_t lo16(int32_t v);
@@ -187,4 +328,12 @@ private:
   static bool parseOutputName(const String& n, Output& out);
 
   void emitEvent(uint8_t id, const char* tag, bool v);
+
+  void armMove(MotorState& m, MoveHandle& h, uint32_t startMs, uint32_t timeoutMs, MoveCallback cb);
+  void finishMove(MotorState& m, MoveState state, uint32_t now);
+  void trackMove(MotorState& m, bool mov, bool ipo, bool alm, uint32_t now);
+  MotorState* findMove(const MoveHandle& h);
+  void abortMove(uint8_t id);
+
+  void recPoll(MotorState& m, uint16_t raw, uint16_t alarmCode, bool movRise, bool ipoRise);
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Convert VJ_OrientalMaster recExport() blocks to CSV.
+
+Usage: vj_telemetry_csv.py dump.bin [out.csv]
+The input may contain several blocks back to back (e.g. one per motor).
+"""
+import csv
+import struct
+import sys
+
+HEADER = struct.Struct("<4sBBBBHHI")   # magic, version, id, sampleSize, decimation, count, total, dropped
+SAMPLE = struct.Struct("<IiiHH")       # tMs, fbp, cmp, out, alarm
+
+
+def blocks(data):
+    pos = 0
+    while pos + HEADER.size <= len(data):
+        magic, version, motor_id, sample_size, decimation, count, total, dropped = HEADER.unpack_from(data, pos)
+        if magic != b"VJTR" or version != 1 or sample_size != SAMPLE.size:
+            raise ValueError("bad block header at offset %d" % pos)
+        pos += HEADER.size
+        for _ in range(count):
+            yield (motor_id,) + SAMPLE.unpack_from(data, pos)
+            pos += sample_size
+        if total > count:
+            sys.stderr.write("motor %d: export truncated, oldest %d of %d samples missing\n"
+                             % (motor_id, total - count, total))
+        if dropped:
+            sys.stderr.write("motor %d: %d samples overwritten\n" % (motor_id, dropped))
+
+
+def write_csv(data, out):
+    w = csv.writer(out)
+    w.writerow(["id", "t_ms", "fbp", "cmp", "out", "alarm", "ready", "alm", "move", "inpos"])
+    for motor_id, t, fbp, cmp_, word, alarm in blocks(data):
+        w.writerow([motor_id, t, fbp, cmp_, "0x%04X" % word, alarm,
+                    (word >> 5) & 1, (word >> 7) & 1, (word >> 13) & 1, (word >> 14) & 1])
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 2
+    with open(argv[1], "rb") as f:
+        data = f.read()
+    if len(argv) > 2:
+        with open(argv[2], "w", newline="") as out:
+            write_csv(data, out)
+    else:
+        write_csv(data, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))